@@ -5,6 +5,9 @@
 
 #define HASH_SIZE 101    /* tamanho da tabela hash */
 #define MAX_STR 128
+#define MAX_SUSPEITOS 16      /* capacidade do registro de suspeitos */
+#define SUSPEITOS_HASH_SIZE 31 /* tamanho da hash de nomes normalizados */
+#define DIST_MAX_SUGESTAO 2   /* distância de edição máxima para "você quis dizer" */
 
 /* --- Estruturas --- */
 
@@ -22,10 +25,11 @@ typedef struct PistaNode {
     struct PistaNode *dir;
 } PistaNode;
 
-/* Associação pista -> suspeito na tabela hash (encadeamento) */
+/* Associação pista -> suspeito na tabela hash (encadeamento).
+   O suspeito é guardado pelo seu ID no registro de suspeitos. */
 typedef struct HashNode {
     char pista[MAX_STR];
-    char suspeito[MAX_STR];
+    int suspeitoId;
     struct HashNode *prox;
 } HashNode;
 
@@ -34,32 +38,62 @@ typedef struct {
     HashNode *v[HASH_SIZE];
 } HashTable;
 
+/* Nó da hash de nomes: chave normalizada -> ID do suspeito */
+typedef struct NomeNode {
+    char chave[MAX_STR];
+    int id;
+    struct NomeNode *prox;
+} NomeNode;
+
+/* Registro de suspeitos montado no carregamento do jogo.
+   O ID de um suspeito é seu índice em nome[]/chave[]. */
+typedef struct {
+    char nome[MAX_SUSPEITOS][MAX_STR];   /* nome de exibição, ex.: "Sr. Black" */
+    char chave[MAX_SUSPEITOS][MAX_STR];  /* nome normalizado, ex.: "sr. black" */
+    int pistas[MAX_SUSPEITOS];           /* pistas coletadas que apontam para cada um */
+    int total;
+    NomeNode *v[SUSPEITOS_HASH_SIZE];
+} RegistroSuspeitos;
+
 /* --- Protótipos --- */
 
 /* criarSala() – cria dinamicamente um cômodo. */
 Sala *criarSala(const char *nome);
 
 /* explorarSalas() – navega pela árvore e ativa o sistema de pistas. */
-void explorarSalas(Sala *root, PistaNode **colecao, HashTable *ht);
+void explorarSalas(Sala *root, PistaNode **colecao, HashTable *ht, RegistroSuspeitos *reg);
 
 /* inserirPista() / adicionarPista() – insere a pista coletada na árvore de pistas. */
-PistaNode *inserirPista(PistaNode *root, const char *pista);
+PistaNode *inserirPista(PistaNode *root, const char *pista, int *inserida);
 void listarPistasInorder(PistaNode *root);
 int contarPistas(PistaNode *root);
 
 /* inserirNaHash() – insere associação pista/suspeito na tabela hash. */
-void inserirNaHash(HashTable *ht, const char *pista, const char *suspeito);
+void inserirNaHash(HashTable *ht, RegistroSuspeitos *reg, const char *pista, const char *suspeito);
+
+/* encontrarSuspeito() – consulta o ID do suspeito correspondente a uma pista. */
+int encontrarSuspeito(HashTable *ht, const char *pista);
+
+/* normalizarNome() – gera a chave de busca de um nome (caixa, espaços e acentos). */
+void normalizarNome(const char *nome, char *chave, size_t tam);
+
+/* registrarSuspeito() / buscarPorChave() – cadastro e consulta por nome normalizado. */
+int registrarSuspeito(RegistroSuspeitos *reg, const char *nome);
+static int buscarPorChave(const RegistroSuspeitos *reg, const char *chave);
 
-/* encontrarSuspeito() – consulta o suspeito correspondente a uma pista. */
-const char *encontrarSuspeito(HashTable *ht, const char *pista);
+/* sugerirSuspeito() – busca aproximada ("você quis dizer...?"). */
+int sugerirSuspeito(const RegistroSuspeitos *reg, const char *chave);
 
 /* verificarSuspeitoFinal() – conduz à fase de julgamento final. */
-void verificarSuspeitoFinal(PistaNode *colecao, HashTable *ht, const char *acusado);
+void verificarSuspeitoFinal(PistaNode *colecao, const RegistroSuspeitos *reg, int acusadoId);
 
 /* Funções auxiliares */
 unsigned long hash_djb2(const char *str);
 void initHashTable(HashTable *ht);
 void liberarHash(HashTable *ht);
+void initRegistro(RegistroSuspeitos *reg);
+void liberarRegistro(RegistroSuspeitos *reg);
+int distanciaEdicao(const char *a, const char *b, int limite);
 void liberarPistas(PistaNode *root);
 void liberarSalas(Sala *root);
 
@@ -83,15 +117,16 @@ Sala *criarSala(const char *nome) {
 }
 
 /* inserirNaHash() – insere associação pista/suspeito na tabela hash.
-   Usa encadeamento; se a pista já existir, sobrescreve o suspeito. */
-void inserirNaHash(HashTable *ht, const char *pista, const char *suspeito) {
+   O suspeito é cadastrado no registro (se ainda não existir) e a hash guarda
+   apenas seu ID. Usa encadeamento; se a pista já existir, sobrescreve o suspeito. */
+void inserirNaHash(HashTable *ht, RegistroSuspeitos *reg, const char *pista, const char *suspeito) {
+    int id = registrarSuspeito(reg, suspeito);
     unsigned long h = hash_djb2(pista) % HASH_SIZE;
     HashNode *cur = ht->v[h];
     while (cur) {
         if (strcmp(cur->pista, pista) == 0) {
             /* atualiza suspeito */
-            strncpy(cur->suspeito, suspeito, MAX_STR-1);
-            cur->suspeito[MAX_STR-1] = '\0';
+            cur->suspeitoId = id;
             return;
         }
         cur = cur->prox;
@@ -101,27 +136,152 @@ void inserirNaHash(HashTable *ht, const char *pista, const char *suspeito) {
     if (!n) { fprintf(stderr, "Erro de memória na hash\n"); exit(EXIT_FAILURE); }
     strncpy(n->pista, pista, MAX_STR-1);
     n->pista[MAX_STR-1] = '\0';
-    strncpy(n->suspeito, suspeito, MAX_STR-1);
-    n->suspeito[MAX_STR-1] = '\0';
+    n->suspeitoId = id;
     n->prox = ht->v[h];
     ht->v[h] = n;
 }
 
 /* encontrarSuspeito() – consulta o suspeito correspondente a uma pista.
-   Retorna ponteiro para string interna (não liberar) ou NULL se não encontrado. */
-const char *encontrarSuspeito(HashTable *ht, const char *pista) {
+   Retorna o ID do suspeito no registro ou -1 se a pista não estiver mapeada. */
+int encontrarSuspeito(HashTable *ht, const char *pista) {
     unsigned long h = hash_djb2(pista) % HASH_SIZE;
     HashNode *cur = ht->v[h];
     while (cur) {
-        if (strcmp(cur->pista, pista) == 0) return cur->suspeito;
+        if (strcmp(cur->pista, pista) == 0) return cur->suspeitoId;
         cur = cur->prox;
     }
-    return NULL;
+    return -1;
+}
+
+/* Letra base para cada caractere latino U+00C0..U+00FF (segundo byte 0x80..0xBF
+   após o prefixo UTF-8 0xC3). '^' indica letra sem forma base ASCII (Æ, Þ),
+   mantida em UTF-8 na forma minúscula; '*' indica ×, ÷ e ß, mantidos como estão. */
+static const char acentosLatin1[64] =
+    "aaaaaa^ceeeeiiiidnooooo*ouuuuy^*"   /* À..ß */
+    "aaaaaa^ceeeeiiiidnooooo*ouuuuy^y";  /* à..ÿ */
+
+/* normalizarNome() – gera a chave de busca de um nome.
+   - ASCII A..Z vira minúscula;
+   - U+00C0..U+00FF (bytes C3 80..C3 BF) vira a letra base ASCII ("Ótávio" ->
+     "otavio"); Æ/Þ viram æ/þ e ×, ÷, ß ficam como estão;
+   - marcas combinantes U+0300..U+036F (bytes CC 80..CD AF) são removidas, então
+     a forma decomposta (NFD) gera a mesma chave que a pré-composta;
+   - espaços nas pontas são eliminados e sequências de espaços (incluindo o
+     espaço não separável U+00A0) viram um único espaço.
+   Demais bytes são copiados sem alteração. */
+void normalizarNome(const char *nome, char *chave, size_t tam) {
+    const unsigned char *p = (const unsigned char *)nome;
+    size_t n = 0;
+    int espacoPendente = 0;
+    if (tam == 0) return;
+    while (*p) {
+        unsigned char out[2];
+        size_t len = 0;
+        if (isspace(*p)) {
+            espacoPendente = 1;
+            p++;
+            continue;
+        }
+        if (p[0] == 0xC2 && p[1] == 0xA0) {
+            espacoPendente = 1;
+            p += 2;
+            continue;
+        }
+        if ((p[0] == 0xCC && p[1] >= 0x80 && p[1] <= 0xBF) ||
+            (p[0] == 0xCD && p[1] >= 0x80 && p[1] <= 0xAF)) {
+            p += 2;   /* marca combinante (acento decomposto) */
+            continue;
+        }
+        if (p[0] == 0xC3 && p[1] >= 0x80 && p[1] <= 0xBF) {
+            char base = acentosLatin1[p[1] - 0x80];
+            if (base == '^') {
+                out[len++] = p[0];
+                out[len++] = p[1] | 0x20;   /* C3 86 -> C3 A6, C3 9E -> C3 BE */
+            } else if (base == '*') {
+                out[len++] = p[0];
+                out[len++] = p[1];
+            } else {
+                out[len++] = (unsigned char)base;
+            }
+            p += 2;
+        } else if (*p < 0x80) {
+            out[len++] = (unsigned char)tolower(*p);
+            p++;
+        } else {
+            out[len++] = *p++;   /* demais bytes UTF-8 são copiados sem alteração */
+        }
+        if (espacoPendente && n > 0) {
+            if (n + 1 >= tam) break;
+            chave[n++] = ' ';
+        }
+        espacoPendente = 0;
+        if (n + len >= tam) break;
+        memcpy(chave + n, out, len);
+        n += len;
+    }
+    chave[n] = '\0';
+}
+
+/* registrarSuspeito() – cadastra um suspeito pelo nome de exibição.
+   Nomes que normalizam para a mesma chave recebem o mesmo ID.
+   Retorna o ID do suspeito. */
+int registrarSuspeito(RegistroSuspeitos *reg, const char *nome) {
+    char chave[MAX_STR];
+    normalizarNome(nome, chave, sizeof(chave));
+    int id = buscarPorChave(reg, chave);
+    if (id >= 0) return id;
+    if (reg->total >= MAX_SUSPEITOS) {
+        fprintf(stderr, "Registro de suspeitos cheio\n");
+        exit(EXIT_FAILURE);
+    }
+    NomeNode *n = (NomeNode *)malloc(sizeof(NomeNode));
+    if (!n) { fprintf(stderr, "Erro de memória no registro de suspeitos\n"); exit(EXIT_FAILURE); }
+    id = reg->total++;
+    strncpy(reg->nome[id], nome, MAX_STR-1);
+    reg->nome[id][MAX_STR-1] = '\0';
+    strcpy(reg->chave[id], chave);
+    reg->pistas[id] = 0;
+    unsigned long h = hash_djb2(chave) % SUSPEITOS_HASH_SIZE;
+    strcpy(n->chave, chave);
+    n->id = id;
+    n->prox = reg->v[h];
+    reg->v[h] = n;
+    return id;
+}
+
+/* buscarPorChave() – consulta o ID de um suspeito por uma chave já
+   normalizada (ver normalizarNome()), então "  sr.  BLACK " encontra
+   "Sr. Black". Retorna -1 se não houver suspeito com essa chave. */
+static int buscarPorChave(const RegistroSuspeitos *reg, const char *chave) {
+    unsigned long h = hash_djb2(chave) % SUSPEITOS_HASH_SIZE;
+    for (NomeNode *cur = reg->v[h]; cur; cur = cur->prox) {
+        if (strcmp(cur->chave, chave) == 0) return cur->id;
+    }
+    return -1;
+}
+
+/* sugerirSuspeito() – busca aproximada para nomes digitados com erro.
+   Retorna o ID do suspeito cuja chave está mais próxima (distância de edição
+   até DIST_MAX_SUGESTAO) ou -1 se nenhum estiver perto o bastante.
+   Recebe a chave já normalizada. */
+int sugerirSuspeito(const RegistroSuspeitos *reg, const char *chave) {
+    if (chave[0] == '\0') return -1;
+    int melhor = -1;
+    int melhorDist = DIST_MAX_SUGESTAO + 1;
+    for (int i = 0; i < reg->total && melhorDist > 0; ++i) {
+        int d = distanciaEdicao(chave, reg->chave[i], melhorDist - 1);
+        if (d < melhorDist) {
+            melhorDist = d;
+            melhor = i;
+        }
+    }
+    return melhor;
 }
 
 /* inserirPista() / adicionarPista() – insere a pista coletada na árvore de pistas.
-   Mantém ordem. Se já existir a pista, não insere. */
-PistaNode *inserirPista(PistaNode *root, const char *pista) {
+   Mantém ordem. Se já existir a pista, não insere.
+   *inserida recebe 1 se um novo nó foi criado e 0 se a pista era repetida. */
+PistaNode *inserirPista(PistaNode *root, const char *pista, int *inserida) {
     if (!root) {
         PistaNode *n = (PistaNode *)malloc(sizeof(PistaNode));
         if (!n) { fprintf(stderr, "Erro de memória na BST de pistas\n"); exit(EXIT_FAILURE); }
@@ -129,16 +289,18 @@ PistaNode *inserirPista(PistaNode *root, const char *pista) {
         n->pista[MAX_STR-1] = '\0';
         n->esq = n->dir = NULL;
         printf("Pista \"%s\" adicionada à coleção.\n", pista);
+        *inserida = 1;
         return n;
     }
     int cmp = strcmp(pista, root->pista);
     if (cmp == 0) {
         printf("Você já coletou a pista \"%s\" antes. Não duplicando.\n", pista);
+        *inserida = 0;
         return root;
     } else if (cmp < 0) {
-        root->esq = inserirPista(root->esq, pista);
+        root->esq = inserirPista(root->esq, pista, inserida);
     } else {
-        root->dir = inserirPista(root->dir, pista);
+        root->dir = inserirPista(root->dir, pista, inserida);
     }
     return root;
 }
@@ -157,24 +319,16 @@ int contarPistas(PistaNode *root) {
 }
 
 /* verificarSuspeitoFinal() – conduz à fase de julgamento final.
-   Conta quantas pistas na coleção apontam para o suspeito acusado.
+   Usa a contagem de pistas do suspeito acusado, mantida por explorarSalas()
+   a cada pista nova coletada.
    Se >= 2 -> acusação sustentada; senão -> insuficiente. */
-void verificarSuspeitoFinal(PistaNode *colecao, HashTable *ht, const char *acusado) {
+void verificarSuspeitoFinal(PistaNode *colecao, const RegistroSuspeitos *reg, int acusadoId) {
     if (!colecao) {
         printf("Nenhuma pista coletada. Acusação impossível.\n");
         return;
     }
-    /* Faz travessia e conta */
-    int contador = 0;
-    /* função interna recursiva */
-    void contarRec(PistaNode *node) {
-        if (!node) return;
-        contarRec(node->esq);
-        const char *s = encontrarSuspeito(ht, node->pista);
-        if (s && strcmp(s, acusado) == 0) contador++;
-        contarRec(node->dir);
-    }
-    contarRec(colecao);
+    const char *acusado = reg->nome[acusadoId];
+    int contador = reg->pistas[acusadoId];
     printf("\nResultado do julgamento contra \"%s\":\n", acusado);
     if (contador >= 2) {
         printf("=> Acusação SUSTENTADA! %d pista(s) apontam para %s.\n", contador, acusado);
@@ -187,8 +341,9 @@ void verificarSuspeitoFinal(PistaNode *colecao, HashTable *ht, const char *acusa
 
 /* explorarSalas() – navega pela árvore e ativa o sistema de pistas.
    Interatividade: e (esquerda), d (direita), s (sair/terminar exploração).
-   Ao entrar em uma sala, exibe sua pista (se existir) e pergunta se jogador quer coletar. */
-void explorarSalas(Sala *root, PistaNode **colecao, HashTable *ht) {
+   Ao entrar em uma sala, exibe sua pista (se existir) e pergunta se jogador quer coletar.
+   Cada pista nova soma 1 à contagem do suspeito associado em reg->pistas[]. */
+void explorarSalas(Sala *root, PistaNode **colecao, HashTable *ht, RegistroSuspeitos *reg) {
     if (!root) return;
     Sala *atual = root;
     char cmd[8];
@@ -200,7 +355,12 @@ void explorarSalas(Sala *root, PistaNode **colecao, HashTable *ht) {
             printf("Deseja coletar esta pista? (s/n): ");
             if (!fgets(cmd, sizeof(cmd), stdin)) exit(EXIT_FAILURE);
             if (tolower(cmd[0]) == 's') {
-                *colecao = inserirPista(*colecao, pista);
+                int inserida = 0;
+                *colecao = inserirPista(*colecao, pista, &inserida);
+                if (inserida) {
+                    int id = encontrarSuspeito(ht, pista);
+                    if (id >= 0) reg->pistas[id]++;
+                }
             } else {
                 printf("Você deixou a pista para trás.\n");
             }
@@ -261,6 +421,48 @@ void liberarHash(HashTable *ht) {
     }
 }
 
+void initRegistro(RegistroSuspeitos *reg) {
+    reg->total = 0;
+    for (int i = 0; i < SUSPEITOS_HASH_SIZE; ++i) reg->v[i] = NULL;
+}
+
+void liberarRegistro(RegistroSuspeitos *reg) {
+    for (int i = 0; i < SUSPEITOS_HASH_SIZE; ++i) {
+        NomeNode *cur = reg->v[i];
+        while (cur) {
+            NomeNode *t = cur;
+            cur = cur->prox;
+            free(t);
+        }
+        reg->v[i] = NULL;
+    }
+    reg->total = 0;
+}
+
+/* distanciaEdicao() – distância de Levenshtein limitada.
+   Retorna a distância entre a e b, ou limite+1 assim que ela certamente
+   ultrapassar o limite (corte pela diferença de tamanho ou pelo mínimo da linha). */
+int distanciaEdicao(const char *a, const char *b, int limite) {
+    int la = (int)strlen(a), lb = (int)strlen(b);
+    if (abs(la - lb) > limite) return limite + 1;
+    int ant[MAX_STR], atual[MAX_STR];
+    for (int j = 0; j <= lb; ++j) ant[j] = j;
+    for (int i = 1; i <= la; ++i) {
+        int minLinha = atual[0] = i;
+        for (int j = 1; j <= lb; ++j) {
+            int custo = (a[i-1] == b[j-1]) ? 0 : 1;
+            int d = ant[j-1] + custo;
+            if (ant[j] + 1 < d) d = ant[j] + 1;
+            if (atual[j-1] + 1 < d) d = atual[j-1] + 1;
+            atual[j] = d;
+            if (d < minLinha) minLinha = d;
+        }
+        if (minLinha > limite) return limite + 1;
+        memcpy(ant, atual, (size_t)(lb + 1) * sizeof(int));
+    }
+    return ant[lb] <= limite ? ant[lb] : limite + 1;
+}
+
 void liberarPistas(PistaNode *root) {
     if (!root) return;
     liberarPistas(root->esq);
@@ -317,24 +519,27 @@ int main(void) {
     cozinha->esq = despensa;
     cozinha->dir = salaJantar;
 
-    /* Inicializa tabela hash e popula com pistas -> suspeitos (mapa pré-definido) */
+    /* Inicializa tabela hash e popula com pistas -> suspeitos (mapa pré-definido).
+       Cada suspeito é cadastrado no registro na primeira vez em que aparece. */
     HashTable ht;
+    RegistroSuspeitos reg;
     initHashTable(&ht);
+    initRegistro(&reg);
 
     /* Associações pré-definidas (pistas como chaves, suspeitos como valores) */
-    inserirNaHash(&ht, "Um broche dourado caído no chão.", "Sr. Black");
-    inserirNaHash(&ht, "Um livro aberto com anotações estranhas.", "Sra. White");
-    inserirNaHash(&ht, "Uma xícara de chá ainda quente.", "Sr. Green");
-    inserirNaHash(&ht, "Uma carta rasgada com a assinatura do mordomo.", "Mordomo");
-    inserirNaHash(&ht, "Pegadas de sapato molhado.", "Sr. Black");
-    inserirNaHash(&ht, "Um colar quebrado sobre a mesa.", "Sra. White");
+    inserirNaHash(&ht, &reg, "Um broche dourado caído no chão.", "Sr. Black");
+    inserirNaHash(&ht, &reg, "Um livro aberto com anotações estranhas.", "Sra. White");
+    inserirNaHash(&ht, &reg, "Uma xícara de chá ainda quente.", "Sr. Green");
+    inserirNaHash(&ht, &reg, "Uma carta rasgada com a assinatura do mordomo.", "Mordomo");
+    inserirNaHash(&ht, &reg, "Pegadas de sapato molhado.", "Sr. Black");
+    inserirNaHash(&ht, &reg, "Um colar quebrado sobre a mesa.", "Sra. White");
     /* nota: Jardim Interno não tem pista, logo não precisa mapear */
 
     /* coleção de pistas inicialmente vazia (BST) */
     PistaNode *colecao = NULL;
 
     /* Inicia exploração */
-    explorarSalas(hall, &colecao, &ht);
+    explorarSalas(hall, &colecao, &ht, &reg);
 
     /* Fase final: listar pistas e pedir acusação */
     printf("\n=== FASE DE JULGAMENTO ===\n");
@@ -348,24 +553,42 @@ int main(void) {
         char acusado[MAX_STR];
         printf("\nQuem você acusa? Digite o nome do suspeito (ex.: \"Sr. Black\"): ");
         if (!fgets(acusado, sizeof(acusado), stdin)) exit(EXIT_FAILURE);
-        /* remove newline */
+        /* remove newline (espaços e caixa são tratados pela normalização) */
         acusado[strcspn(acusado, "\n")] = '\0';
-        /* trim de espaços iniciais/finais */
-        char *start = acusado;
-        while (*start && isspace((unsigned char)*start)) start++;
-        char *end = start + strlen(start) - 1;
-        while (end > start && isspace((unsigned char)*end)) { *end = '\0'; end--; }
+        char chave[MAX_STR];
+        normalizarNome(acusado, chave, sizeof(chave));
 
-        if (strlen(start) == 0) {
+        if (chave[0] == '\0') {
             printf("Nome do acusado vazio. Encerrando sem acusação.\n");
         } else {
-            verificarSuspeitoFinal(colecao, &ht, start);
+            int id = buscarPorChave(&reg, chave);
+            if (id < 0) {
+                /* nome não reconhecido: oferece o suspeito mais parecido */
+                int sugestao = sugerirSuspeito(&reg, chave);
+                if (sugestao >= 0) {
+                    char resp[8];
+                    printf("Suspeito \"%s\" não encontrado. Você quis dizer \"%s\"? (s/n): ",
+                           acusado, reg.nome[sugestao]);
+                    if (!fgets(resp, sizeof(resp), stdin)) exit(EXIT_FAILURE);
+                    if (tolower(resp[0]) == 's') id = sugestao;
+                }
+            }
+            if (id < 0) {
+                printf("Suspeito \"%s\" desconhecido. Suspeitos:", acusado);
+                for (int i = 0; i < reg.total; ++i) {
+                    printf("%s %s", i ? "," : "", reg.nome[i]);
+                }
+                printf(".\nEncerrando sem acusação.\n");
+            } else {
+                verificarSuspeitoFinal(colecao, &reg, id);
+            }
         }
     }
 
     /* limpa memória */
     liberarPistas(colecao);
     liberarHash(&ht);
+    liberarRegistro(&reg);
     liberarSalas(hall);
 
     printf("\nObrigado por jogar Detective Quest!\n");